@@ -6,6 +6,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <stdint.h>
 
 /**
  * @file graph.c
@@ -18,6 +19,13 @@ Number: 21110
 Date: 24/05/2024
 */
 
+/**
+ * Memory budget, in bytes, for the half paths kept per endpoint by bidirectionalSearch.
+ * Each half path carries a bitset with one bit per vertex, so the number of half paths
+ * that fits in the budget shrinks as the graph grows.
+ */
+#define HALF_PATH_BYTES ((size_t)1 << 30)
+
 /**
  * Initializes a path with a given length.
  * @param length The length of the path.
@@ -372,6 +380,1200 @@ void breadthFirstSearch(Graph* graph, int startVertex, int endVertex, int* maxSu
     free(visited);
 }
 
+/**
+ * Builds a compact adjacency list (offsets/targets layout) from the edge matrix.
+ * Removed vertices and self-loops are skipped, since no simple path can use them.
+ * @param graph The graph to read.
+ * @param reverse If true, each list holds the predecessors of a vertex instead of its successors.
+ * @param offsets Pointer to store the offsets array (numVertices + 1 entries).
+ * @param targets Pointer to store the concatenated neighbour lists.
+ */
+static void buildAdjacency(Graph* graph, bool reverse, int** offsets, int** targets) {
+    int n = graph->numVertices;
+    *offsets = (int*)calloc(n + 1, sizeof(int));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (i != j && graph->edges[i][j] && graph->vertices[i] && graph->vertices[j]) {
+                (*offsets)[(reverse ? j : i) + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        (*offsets)[i + 1] += (*offsets)[i];
+    }
+
+    *targets = (int*)malloc(((*offsets)[n] > 0 ? (*offsets)[n] : 1) * sizeof(int));
+    int* cursor = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    memcpy(cursor, *offsets, n * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (i != j && graph->edges[i][j] && graph->vertices[i] && graph->vertices[j]) {
+                if (reverse) {
+                    (*targets)[cursor[j]++] = i;
+                } else {
+                    (*targets)[cursor[i]++] = j;
+                }
+            }
+        }
+    }
+    free(cursor);
+}
+
+/**
+ * Orders the vertices topologically using Kahn's algorithm.
+ * Vertices that sit on (or behind) a cycle never reach in-degree zero and are left out,
+ * so the graph is acyclic exactly when every present vertex is ordered.
+ * @param graph The graph to order.
+ * @param offsets Offsets of the successor lists built by buildAdjacency.
+ * @param targets Successor lists built by buildAdjacency.
+ * @param order Array of numVertices entries to receive the ordering.
+ * @return The number of vertices written to order.
+ */
+static int topologicalOrder(Graph* graph, int* offsets, int* targets, int* order) {
+    int n = graph->numVertices;
+    int* inDegree = (int*)calloc(n > 0 ? n : 1, sizeof(int));
+    for (int i = 0; i < offsets[n]; i++) {
+        inDegree[targets[i]]++;
+    }
+
+    // The order array doubles as the queue: head reads, count appends
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        if (graph->vertices[i] && inDegree[i] == 0) {
+            order[count++] = i;
+        }
+    }
+    for (int head = 0; head < count; head++) {
+        int v = order[head];
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            if (--inDegree[targets[e]] == 0) {
+                order[count++] = targets[e];
+            }
+        }
+    }
+
+    free(inDegree);
+    return count;
+}
+
+/**
+ * Counts the vertices currently present in the graph (removed slots are NULL).
+ * @param graph The graph to inspect.
+ * @return The number of present vertices.
+ */
+static int countVertices(Graph* graph) {
+    int count = 0;
+    for (int i = 0; i < graph->numVertices; i++) {
+        if (graph->vertices[i]) {
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * Solves the maximum sum path problem on an acyclic graph in linear time.
+ * Vertices are visited in topological order, so every predecessor of a vertex is final
+ * before the vertex itself: the best path ending at a vertex either starts there or
+ * extends the best path ending at one of its predecessors.
+ * @param graph The graph to search.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param order The vertices in topological order.
+ * @param count The number of vertices in order.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum.
+ */
+static void dagLongestPath(Graph* graph, int* offsets, int* targets, int* order, int count, int* maxSum, Path** maxPath) {
+    int n = graph->numVertices;
+    int* prefix = (int*)calloc(n, sizeof(int)); // Best sum before each vertex (0 = start there)
+    int* parent = (int*)malloc(n * sizeof(int));
+    int* best = (int*)malloc(n * sizeof(int));
+    int bestEnd = -1;
+    for (int i = 0; i < n; i++) {
+        parent[i] = -1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        int v = order[i];
+        best[v] = prefix[v] + graph->vertices[v]->value;
+        if (bestEnd < 0 || best[v] > *maxSum) {
+            *maxSum = best[v];
+            bestEnd = v;
+        }
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = targets[e];
+            if (best[v] > prefix[w]) {
+                prefix[w] = best[v];
+                parent[w] = v;
+            }
+        }
+    }
+
+    int length = 0;
+    for (int v = bestEnd; v >= 0; v = parent[v]) {
+        length++;
+    }
+    *maxPath = initializePath(length);
+    (*maxPath)->length = length;
+    for (int v = bestEnd, position = length - 1; v >= 0; v = parent[v], position--) {
+        (*maxPath)->vertices[position] = v;
+    }
+
+    free(prefix);
+    free(parent);
+    free(best);
+}
+
+/**
+ * Advances the layered DP by one step: next[w] becomes the best sum of a path ending at w
+ * that uses one more cell than the paths described by current.
+ * @param graph The graph being solved.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param current Best sums for the current layer (INT_MIN where no path ends).
+ * @param next Array to receive the best sums for the next layer.
+ * @return True if at least one path reaches the next layer, false otherwise.
+ */
+static bool advanceLayer(Graph* graph, int* offsets, int* targets, int* current, int* next) {
+    bool reached = false;
+    for (int i = 0; i < graph->numVertices; i++) {
+        next[i] = INT_MIN;
+    }
+    for (int v = 0; v < graph->numVertices; v++) {
+        if (current[v] == INT_MIN) {
+            continue;
+        }
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = targets[e];
+            int candidate = current[v] + graph->vertices[w]->value;
+            if (candidate > next[w]) {
+                next[w] = candidate;
+                reached = true;
+            }
+        }
+    }
+    return reached;
+}
+
+/**
+ * Solves the constrained problem on an acyclic graph with a layered DP over (vertex, steps used).
+ * The forward pass keeps two rolling layers plus a checkpoint copy every ceil(sqrt(L)) layers.
+ * The winning path is rebuilt backwards one segment at a time: each segment's layers are
+ * recomputed once from its checkpoint, so every layer is computed at most twice.
+ * This costs O(L * (V + E)) time and O(V * sqrt(L)) memory on top of the adjacency.
+ * @param graph The graph to search.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param maxLength The maximum number of cells on the path.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum.
+ */
+static void constrainedLayeredSearch(Graph* graph, int* offsets, int* targets, int maxLength, int* maxSum, Path** maxPath) {
+    int n = graph->numVertices;
+    int stride = 1;
+    while ((long long)stride * stride < maxLength) {
+        stride++;
+    }
+    int* current = (int*)malloc(n * sizeof(int));
+    int* next = (int*)malloc(n * sizeof(int));
+    int* checkpoints = (int*)malloc((size_t)((maxLength - 1) / stride + 1) * n * sizeof(int)); // Layer 1 + k * stride in row k
+    int* segment = (int*)malloc((size_t)stride * n * sizeof(int));
+    int bestEnd = -1;
+    int bestSteps = 0;
+
+    for (int i = 0; i < n; i++) {
+        current[i] = graph->vertices[i] ? graph->vertices[i]->value : INT_MIN;
+    }
+    for (int steps = 1; steps <= maxLength; steps++) {
+        if ((steps - 1) % stride == 0) {
+            memcpy(checkpoints + (size_t)((steps - 1) / stride) * n, current, n * sizeof(int));
+        }
+        for (int v = 0; v < n; v++) {
+            if (current[v] != INT_MIN && current[v] > *maxSum) {
+                *maxSum = current[v];
+                bestEnd = v;
+                bestSteps = steps;
+            }
+        }
+        if (steps == maxLength || !advanceLayer(graph, offsets, targets, current, next)) {
+            break;
+        }
+        int* temp = current;
+        current = next;
+        next = temp;
+    }
+
+    if (bestEnd >= 0) {
+        // Walk backwards from the best end vertex, picking any predecessor whose layer value matches
+        *maxPath = initializePath(bestSteps);
+        (*maxPath)->length = bestSteps;
+        int vertex = bestEnd;
+        int remaining = *maxSum;
+        int loaded = -1; // Checkpoint whose segment is currently held in segment
+        for (int steps = bestSteps; steps > 1; steps--) {
+            (*maxPath)->vertices[steps - 1] = vertex;
+            remaining -= graph->vertices[vertex]->value;
+
+            int layerSteps = steps - 1;
+            int checkpoint = (layerSteps - 1) / stride;
+            int offset = layerSteps - 1 - checkpoint * stride;
+            if (checkpoint != loaded) {
+                // The walk goes downwards, so the first layer needed is the highest one in the segment
+                memcpy(segment, checkpoints + (size_t)checkpoint * n, n * sizeof(int));
+                for (int i = 1; i <= offset; i++) {
+                    advanceLayer(graph, offsets, targets, segment + (size_t)(i - 1) * n, segment + (size_t)i * n);
+                }
+                loaded = checkpoint;
+            }
+            int* layer = segment + (size_t)offset * n;
+            for (int u = 0; u < n; u++) {
+                if (u != vertex && graph->vertices[u] && graph->edges[u][vertex] && layer[u] == remaining) {
+                    vertex = u;
+                    break;
+                }
+            }
+        }
+        (*maxPath)->vertices[0] = vertex;
+    }
+
+    free(current);
+    free(next);
+    free(checkpoints);
+    free(segment);
+}
+
+/**
+ * Depth-first search with constraint-aware pruning, used when the graph has cycles
+ * or a sum budget is set.
+ * A branch is cut when it would exceed the cell limit, when the budget is already broken
+ * and values cannot decrease the sum, or when even the largest value on every remaining
+ * cell could not beat the best sum found so far.
+ * @param graph The graph to search.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param vertex The vertex being added to the current path.
+ * @param visited An array indicating whether a vertex is on the current path.
+ * @param currentSum The sum of the current path before adding vertex.
+ * @param maxLength The maximum number of cells on the path.
+ * @param maxBudget The maximum allowed path sum.
+ * @param maxValue The largest vertex value in the graph, or 0 if all values are negative.
+ * @param nonNegative True if every vertex value is non-negative.
+ * @param currentPath The current path being explored.
+ * @param maxSum Pointer to the maximum sum found so far.
+ * @param maxPath Pointer to the path with the maximum sum found so far.
+ */
+static void constrainedDepthFirstSearch(Graph* graph, int* offsets, int* targets, int vertex, int* visited, int currentSum, int maxLength, int maxBudget, int maxValue, bool nonNegative, Path* currentPath, int* maxSum, Path** maxPath) {
+    visited[vertex] = 1;
+    addToPath(currentPath, vertex);
+    currentSum += graph->vertices[vertex]->value;
+
+    if (currentSum <= maxBudget && currentSum > *maxSum) {
+        *maxSum = currentSum;
+        if (*maxPath) {
+            freePath(*maxPath);
+        }
+        *maxPath = copyPath(currentPath);
+    }
+
+    long long optimistic = (long long)currentSum + (long long)(maxLength - currentPath->length) * maxValue;
+    if (optimistic > maxBudget) {
+        optimistic = maxBudget;
+    }
+    if (currentPath->length < maxLength && optimistic > *maxSum) {
+        for (int e = offsets[vertex]; e < offsets[vertex + 1]; e++) {
+            int next = targets[e];
+            if (visited[next]) {
+                continue;
+            }
+            if (nonNegative && currentSum + graph->vertices[next]->value > maxBudget) {
+                continue;
+            }
+            constrainedDepthFirstSearch(graph, offsets, targets, next, visited, currentSum, maxLength, maxBudget, maxValue, nonNegative, currentPath, maxSum, maxPath);
+        }
+    }
+
+    currentPath->length--;
+    visited[vertex] = 0;
+}
+
+/**
+ * Finds the maximum sum path that uses at most maxLength cells and whose sum stays within maxBudget.
+ * Acyclic graphs without a budget are solved by a linear topological DP when there is no
+ * length limit, and otherwise by a layered DP in O(L * (V + E)) time and O(V * sqrt(L)) memory; cyclic graphs, or any graph with a budget, fall back to a pruned
+ * depth-first search, which is exponential in the worst case even on acyclic graphs.
+ * @param graph The graph to search.
+ * @param maxLength The maximum number of cells on the path (0 or less means no limit).
+ * @param maxBudget The maximum allowed path sum (INT_MAX means no budget).
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if none fits).
+ * @return True if a path satisfying the limits was found, false otherwise.
+ */
+bool findMaxSumPathConstrained(Graph* graph, int maxLength, int maxBudget, int* maxSum, Path** maxPath) {
+    *maxSum = INT_MIN;
+    *maxPath = NULL;
+
+    int n = graph->numVertices;
+    int present = countVertices(graph);
+    if (present == 0) {
+        return false;
+    }
+    if (maxLength <= 0 || maxLength > present) {
+        maxLength = present; // A simple path never uses more cells than there are vertices
+    }
+
+    int* offsets;
+    int* targets;
+    buildAdjacency(graph, false, &offsets, &targets);
+    int* order = (int*)malloc(n * sizeof(int));
+    int ordered = topologicalOrder(graph, offsets, targets, order);
+    bool acyclic = ordered == present;
+
+    if (acyclic && maxBudget == INT_MAX && maxLength == present) {
+        // No effective limit: the linear topological DP gives the same answer
+        dagLongestPath(graph, offsets, targets, order, ordered, maxSum, maxPath);
+    } else if (acyclic && maxBudget == INT_MAX) {
+        constrainedLayeredSearch(graph, offsets, targets, maxLength, maxSum, maxPath);
+    } else {
+        int maxValue = 0;
+        bool nonNegative = true;
+        for (int i = 0; i < n; i++) {
+            if (graph->vertices[i]) {
+                if (graph->vertices[i]->value > maxValue) {
+                    maxValue = graph->vertices[i]->value;
+                }
+                if (graph->vertices[i]->value < 0) {
+                    nonNegative = false;
+                }
+            }
+        }
+
+        int* visited = (int*)calloc(n, sizeof(int));
+        Path* currentPath = initializePath(maxLength);
+        for (int i = 0; i < n; i++) {
+            if (graph->vertices[i]) {
+                constrainedDepthFirstSearch(graph, offsets, targets, i, visited, 0, maxLength, maxBudget, maxValue, nonNegative, currentPath, maxSum, maxPath);
+            }
+        }
+        freePath(currentPath);
+        free(visited);
+    }
+
+    free(order);
+    free(offsets);
+    free(targets);
+    return *maxPath != NULL;
+}
+
+/**
+ * Structure representing one half of a path in the bidirectional search.
+ * Half paths form a tree: each one extends its parent by a single vertex.
+ */
+typedef struct {
+    int vertex; // Last vertex of the half path (the meeting candidate)
+    int parent; // Index of the half path this one extends, or -1 for the endpoint itself
+    int length; // Number of cells on the half path
+    int sum;    // Sum of the vertex values on the half path
+} HalfPath;
+
+/**
+ * Structure holding every half path expanded from one endpoint, together with a visited
+ * bitset per half path and a hash table used to keep (last vertex, bitset) pairs unique.
+ */
+typedef struct {
+    HalfPath* items; // Half paths in the order they were expanded
+    uint64_t* bits;  // One visited bitset of words entries per half path, in item order
+    int* table;      // Open-addressing hash table of item indices (-1 marks an empty slot)
+    int tableSize;   // Number of slots in the table (a power of two)
+    int words;       // Number of 64-bit words in each bitset
+    int count;       // Number of half paths stored
+    int capacity;    // Number of half paths that fit before growing
+    int limit;       // Largest capacity allowed by HALF_PATH_BYTES
+} HalfPathSet;
+
+/**
+ * Sort key used to group half paths by meeting vertex, best sums first.
+ */
+typedef struct {
+    int vertex;           // Meeting vertex
+    int sum;              // Sum of the half path
+    int index;            // Index of the half path in its set
+    const uint64_t* bits; // Visited bitset of the half path
+} HalfPathKey;
+
+/**
+ * Scratch space for the reachability walks done while expanding and joining half paths.
+ */
+typedef struct {
+    int* queue; // Queue of vertices to visit (numVertices entries)
+    int* marks; // Stamp of the last walk that visited each vertex
+    int stamp;  // Stamp of the most recent walk
+} RegionScratch;
+
+/**
+ * Hashes the last vertex and visited bitset of a half path.
+ * @param bits The visited bitset.
+ * @param words The number of 64-bit words in the bitset.
+ * @param vertex The last vertex of the half path.
+ * @return The hash value.
+ */
+static uint64_t hashHalfPath(const uint64_t* bits, int words, int vertex) {
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t)vertex;
+    for (int w = 0; w < words; w++) {
+        hash ^= bits[w];
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= hash >> 33;
+    }
+    // Final mix so that the low bits used as the table index depend on every input bit
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 29;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * Finds the table slot holding a half path with the given last vertex and bitset,
+ * or the empty slot where it would be inserted.
+ * @param set The set to search.
+ * @param bits The visited bitset.
+ * @param vertex The last vertex of the half path.
+ * @return The slot index.
+ */
+static int findHalfPathSlot(HalfPathSet* set, const uint64_t* bits, int vertex) {
+    int mask = set->tableSize - 1;
+    int slot = (int)(hashHalfPath(bits, set->words, vertex) & (uint64_t)mask);
+    while (set->table[slot] >= 0) {
+        int other = set->table[slot];
+        if (set->items[other].vertex == vertex && memcmp(set->bits + (size_t)other * set->words, bits, set->words * sizeof(uint64_t)) == 0) {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/**
+ * Appends a half path to a set unless one with the same last vertex and visited vertices
+ * is already stored. Such half paths only differ in visiting order, so they have the same
+ * sum and the same extensions, and keeping the first one is enough.
+ * @param set The set to append to.
+ * @param vertex The last vertex of the half path.
+ * @param parent The index of the half path being extended, or -1.
+ * @param sum The sum of the half path.
+ * @return The index of the new half path, -1 if an equivalent one already exists, or -2 if
+ *         the set is full (limit reached) or memory could not be allocated.
+ */
+static int appendHalfPath(HalfPathSet* set, int vertex, int parent, int sum) {
+    if (set->count == set->capacity) {
+        if (set->capacity >= set->limit) {
+            return -2;
+        }
+        int capacity = set->capacity ? set->capacity * 2 : 64;
+        if (capacity > set->limit) {
+            capacity = set->limit;
+        }
+        HalfPath* items = (HalfPath*)realloc(set->items, capacity * sizeof(HalfPath));
+        if (!items) {
+            return -2;
+        }
+        set->items = items;
+        uint64_t* bits = (uint64_t*)realloc(set->bits, (size_t)capacity * set->words * sizeof(uint64_t));
+        if (!bits) {
+            return -2;
+        }
+        set->bits = bits;
+        set->capacity = capacity;
+    }
+    if (set->count * 2 >= set->tableSize) {
+        // Keep the table at most half full, rehashing every stored half path
+        int tableSize = set->tableSize ? set->tableSize * 2 : 128;
+        int* table = (int*)malloc(tableSize * sizeof(int));
+        if (!table) {
+            return -2;
+        }
+        free(set->table);
+        set->table = table;
+        set->tableSize = tableSize;
+        memset(set->table, -1, set->tableSize * sizeof(int));
+        for (int i = 0; i < set->count; i++) {
+            set->table[findHalfPathSlot(set, set->bits + (size_t)i * set->words, set->items[i].vertex)] = i;
+        }
+    }
+
+    // Build the bitset in the next free row first, then check whether it is new
+    int index = set->count;
+    uint64_t* bits = set->bits + (size_t)index * set->words;
+    if (parent >= 0) {
+        memcpy(bits, set->bits + (size_t)parent * set->words, set->words * sizeof(uint64_t));
+    } else {
+        memset(bits, 0, set->words * sizeof(uint64_t));
+    }
+    bits[vertex / 64] |= (uint64_t)1 << (vertex % 64);
+
+    int slot = findHalfPathSlot(set, bits, vertex);
+    if (set->table[slot] >= 0) {
+        return -1;
+    }
+    set->table[slot] = index;
+    set->count++;
+
+    set->items[index].vertex = vertex;
+    set->items[index].parent = parent;
+    set->items[index].length = parent >= 0 ? set->items[parent].length + 1 : 1;
+    set->items[index].sum = sum;
+    return index;
+}
+
+/**
+ * Empties a set of half paths, keeping its storage for the next pass.
+ * @param set The set to clear.
+ */
+static void clearHalfPathSet(HalfPathSet* set) {
+    set->count = 0;
+    if (set->table) {
+        memset(set->table, -1, set->tableSize * sizeof(int));
+    }
+}
+
+/**
+ * Walks the region reachable from a vertex without entering a set of blocked vertices.
+ * Any continuation of a half path stays inside this region, so it must contain the vertex
+ * at the other end of the search, and the positive values in it bound what can be added.
+ * @param graph The graph being searched.
+ * @param offsets Offsets of the adjacency lists to follow.
+ * @param targets Adjacency lists to follow.
+ * @param scratch Scratch space for the walk.
+ * @param blocked Bitset of the vertices that may not be entered.
+ * @param from The vertex to start from (entered even if blocked).
+ * @param targetVertex The vertex that must be reachable.
+ * @return The value of from plus the positive values of the other reachable vertices,
+ *         or INT_MIN if targetVertex cannot be reached.
+ */
+static int reachableValue(Graph* graph, int* offsets, int* targets, RegionScratch* scratch, const uint64_t* blocked, int from, int targetVertex) {
+    int stamp = ++scratch->stamp;
+    int count = 0;
+    int bound = graph->vertices[from]->value;
+    bool reached = from == targetVertex;
+    scratch->queue[count++] = from;
+    scratch->marks[from] = stamp;
+    for (int head = 0; head < count; head++) {
+        int v = scratch->queue[head];
+        for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+            int w = targets[e];
+            if (scratch->marks[w] != stamp && !((blocked[w / 64] >> (w % 64)) & 1)) {
+                scratch->marks[w] = stamp;
+                scratch->queue[count++] = w;
+                reached = reached || w == targetVertex;
+                if (graph->vertices[w]->value > 0) {
+                    bound += graph->vertices[w]->value;
+                }
+            }
+        }
+    }
+    return reached ? bound : INT_MIN;
+}
+
+/**
+ * Expands every simple half path from a half path up to a maximum number of cells.
+ * A half path is dropped when the other endpoint can no longer be reached from it, or when
+ * its sum plus every positive value still reachable stays below the threshold.
+ * @param graph The graph being searched.
+ * @param offsets Offsets of the adjacency lists to follow.
+ * @param targets Adjacency lists to follow.
+ * @param set The set receiving the half paths.
+ * @param scratch Scratch space for the reachability walks.
+ * @param index The index of the half path to extend.
+ * @param maxLength The maximum number of cells on a half path.
+ * @param targetVertex The other endpoint of the search.
+ * @param forward True when expanding from the start: half paths may end at targetVertex but
+ *                are not extended past it. When false, targetVertex is never entered.
+ * @param threshold The smallest full path sum still of interest.
+ * @return False if the set ran out of room, true otherwise.
+ */
+static bool expandHalfPaths(Graph* graph, int* offsets, int* targets, HalfPathSet* set, RegionScratch* scratch, int index, int maxLength, int targetVertex, bool forward, long long threshold) {
+    int vertex = set->items[index].vertex;
+    if (set->items[index].length == maxLength || vertex == targetVertex) {
+        return true;
+    }
+
+    for (int e = offsets[vertex]; e < offsets[vertex + 1]; e++) {
+        int next = targets[e];
+        // The bitset pointer is re-read because appending may move the storage
+        uint64_t* bits = set->bits + (size_t)index * set->words;
+        if ((!forward && next == targetVertex) || (bits[next / 64] >> (next % 64)) & 1) {
+            continue;
+        }
+        int region = reachableValue(graph, offsets, targets, scratch, bits, next, targetVertex);
+        if (region == INT_MIN || (long long)set->items[index].sum + region < threshold) {
+            continue;
+        }
+        int child = appendHalfPath(set, next, index, set->items[index].sum + graph->vertices[next]->value);
+        if (child == -2) {
+            return false;
+        }
+        if (child < 0) {
+            continue; // Reached before through the same vertices in another order
+        }
+        if (!expandHalfPaths(graph, offsets, targets, set, scratch, child, maxLength, targetVertex, forward, threshold)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Orders half path keys by meeting vertex, then by descending sum.
+ * @param a The first key.
+ * @param b The second key.
+ * @return A negative, zero or positive value, as required by qsort.
+ */
+static int compareHalfPathKeys(const void* a, const void* b) {
+    const HalfPathKey* left = (const HalfPathKey*)a;
+    const HalfPathKey* right = (const HalfPathKey*)b;
+    if (left->vertex != right->vertex) {
+        return left->vertex < right->vertex ? -1 : 1;
+    }
+    if (left->sum != right->sum) {
+        return left->sum > right->sum ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Builds the sorted join keys for a set of half paths.
+ * @param set The half paths to index.
+ * @param requiredLength Only half paths of this many cells (or ending at finalVertex) are kept; 0 keeps all.
+ * @param finalVertex A vertex whose half paths are kept regardless of length (-1 for none).
+ * @param count Pointer to store the number of keys built.
+ * @return The array of keys, sorted by compareHalfPathKeys, or NULL if it could not be allocated.
+ */
+static HalfPathKey* buildHalfPathKeys(HalfPathSet* set, int requiredLength, int finalVertex, int* count) {
+    HalfPathKey* keys = (HalfPathKey*)malloc((set->count > 0 ? set->count : 1) * sizeof(HalfPathKey));
+    *count = 0;
+    if (!keys) {
+        return NULL;
+    }
+    for (int i = 0; i < set->count; i++) {
+        if (requiredLength == 0 || set->items[i].length == requiredLength || set->items[i].vertex == finalVertex) {
+            keys[*count].vertex = set->items[i].vertex;
+            keys[*count].sum = set->items[i].sum;
+            keys[*count].index = i;
+            keys[*count].bits = set->bits + (size_t)i * set->words;
+            (*count)++;
+        }
+    }
+    qsort(keys, *count, sizeof(HalfPathKey), compareHalfPathKeys);
+    return keys;
+}
+
+/**
+ * Runs one meet-in-the-middle pass, looking only for paths whose sum reaches the threshold.
+ * Each path is split at a single canonical meeting vertex: the forward half holds its first
+ * forwardLength cells (all of them if the path is shorter), so every path is considered
+ * exactly once. Halves meeting at the same vertex are joined when their visited bitsets
+ * share only that vertex. Backward halves are tried best sum first, starting from the first
+ * one small enough to fit in the region the forward half leaves reachable.
+ * @param graph The graph to search.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param reverseOffsets Offsets of the predecessor lists.
+ * @param reverseTargets Predecessor lists.
+ * @param forward Set receiving the half paths expanded from the start.
+ * @param backward Set receiving the half paths expanded from the end.
+ * @param scratch Scratch space for the reachability walks.
+ * @param startVertex The starting vertex of the path.
+ * @param endVertex The ending vertex of the path.
+ * @param threshold The smallest path sum of interest.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (left NULL if none reaches the threshold).
+ * @return False if the half paths did not fit in memory, true otherwise.
+ */
+static bool meetInTheMiddle(Graph* graph, int* offsets, int* targets, int* reverseOffsets, int* reverseTargets, HalfPathSet* forward, HalfPathSet* backward, RegionScratch* scratch, int startVertex, int endVertex, long long threshold, int* maxSum, Path** maxPath) {
+    // A simple path has at most present cells; the halves overlap in the meeting vertex
+    int present = countVertices(graph);
+    int forwardLength = (present + 2) / 2;
+    int backwardLength = present + 1 - forwardLength;
+    int words = forward->words;
+
+    clearHalfPathSet(forward);
+    clearHalfPathSet(backward);
+    if (appendHalfPath(forward, startVertex, -1, graph->vertices[startVertex]->value) < 0 ||
+        !expandHalfPaths(graph, offsets, targets, forward, scratch, 0, forwardLength, endVertex, true, threshold) ||
+        appendHalfPath(backward, endVertex, -1, graph->vertices[endVertex]->value) < 0 ||
+        !expandHalfPaths(graph, reverseOffsets, reverseTargets, backward, scratch, 0, backwardLength, startVertex, false, threshold)) {
+        return false;
+    }
+
+    // Forward halves only meet at their canonical split: full length, or already at the end
+    int forwardCount;
+    int backwardCount;
+    HalfPathKey* forwardKeys = buildHalfPathKeys(forward, forwardLength, endVertex, &forwardCount);
+    HalfPathKey* backwardKeys = buildHalfPathKeys(backward, 0, -1, &backwardCount);
+    if (!forwardKeys || !backwardKeys) {
+        free(forwardKeys);
+        free(backwardKeys);
+        return false;
+    }
+
+    long long best = threshold - 1;
+    int bestForward = -1;
+    int bestBackward = -1;
+    int f = 0;
+    int b = 0;
+    while (f < forwardCount && b < backwardCount) {
+        int meet = forwardKeys[f].vertex;
+        if (backwardKeys[b].vertex != meet) {
+            if (backwardKeys[b].vertex < meet) {
+                b++;
+            } else {
+                f++;
+            }
+            continue;
+        }
+
+        int forwardEnd = f;
+        int backwardEnd = b;
+        while (forwardEnd < forwardCount && forwardKeys[forwardEnd].vertex == meet) {
+            forwardEnd++;
+        }
+        while (backwardEnd < backwardCount && backwardKeys[backwardEnd].vertex == meet) {
+            backwardEnd++;
+        }
+
+        int meetValue = graph->vertices[meet]->value;
+        for (int i = f; i < forwardEnd; i++) {
+            // Sums only decrease from here on, so stop once even the best pairing cannot win
+            if ((long long)forwardKeys[i].sum + backwardKeys[b].sum - meetValue <= best) {
+                break;
+            }
+            const uint64_t* forwardBits = forwardKeys[i].bits;
+            int cap = reachableValue(graph, offsets, targets, scratch, forwardBits, meet, endVertex);
+            if (cap == INT_MIN || (long long)forwardKeys[i].sum + cap - meetValue <= best) {
+                continue;
+            }
+
+            // Skip the backward halves whose sum is too large to fit in the reachable region
+            int low = b;
+            int high = backwardEnd;
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (backwardKeys[middle].sum > cap) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            for (int j = low; j < backwardEnd; j++) {
+                long long sum = (long long)forwardKeys[i].sum + backwardKeys[j].sum - meetValue;
+                if (sum <= best) {
+                    break;
+                }
+                const uint64_t* backwardBits = backwardKeys[j].bits;
+                bool overlap = false;
+                for (int w = 0; w < words && !overlap; w++) {
+                    uint64_t shared = forwardBits[w] & backwardBits[w];
+                    if (w == meet / 64) {
+                        shared &= ~((uint64_t)1 << (meet % 64));
+                    }
+                    overlap = shared != 0;
+                }
+                if (!overlap) {
+                    best = sum;
+                    bestForward = forwardKeys[i].index;
+                    bestBackward = backwardKeys[j].index;
+                    break; // Later backward halves for this forward half have smaller sums
+                }
+            }
+        }
+        f = forwardEnd;
+        b = backwardEnd;
+    }
+
+    if (bestForward >= 0) {
+        // Forward half gives start..meet when read back to front; the backward half continues to the end
+        int forwardCells = forward->items[bestForward].length;
+        int length = forwardCells + backward->items[bestBackward].length - 1;
+        *maxSum = (int)best;
+        *maxPath = initializePath(length);
+        (*maxPath)->length = length;
+        for (int i = bestForward, position = forwardCells - 1; i >= 0; i = forward->items[i].parent, position--) {
+            (*maxPath)->vertices[position] = forward->items[i].vertex;
+        }
+        for (int i = backward->items[bestBackward].parent, position = forwardCells; i >= 0; i = backward->items[i].parent, position++) {
+            (*maxPath)->vertices[position] = backward->items[i].vertex;
+        }
+    }
+
+    free(forwardKeys);
+    free(backwardKeys);
+    return true;
+}
+
+/**
+ * Finds the maximum sum simple path between two vertices with a bidirectional
+ * meet-in-the-middle search.
+ * Half paths of up to about half the vertex count are expanded from the start over the
+ * edges and from the end over the reverse edges, then joined at a shared meeting vertex.
+ * Passes are run with a decreasing threshold, starting just below an upper bound on the
+ * answer: a high threshold prunes most half paths, and the first pass that finds a path
+ * has found the best one. The last possible pass has no effective threshold, so the
+ * result is always exact. If the half paths of either side outgrow HALF_PATH_BYTES,
+ * or memory runs out, the search gives up and says so through its return value.
+ * @param graph The graph to search.
+ * @param startVertex The starting vertex of the path.
+ * @param endVertex The ending vertex of the path.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if none was found).
+ * @return 1 if a path was found, 0 if no path exists, or -1 if the search ran out of room
+ *         before it could decide (in which case a path may still exist).
+ */
+int bidirectionalSearch(Graph* graph, int startVertex, int endVertex, int* maxSum, Path** maxPath) {
+    *maxSum = INT_MIN;
+    *maxPath = NULL;
+
+    if (!graph->vertices[startVertex] || !graph->vertices[endVertex]) {
+        return 0;
+    }
+    if (startVertex == endVertex) {
+        *maxSum = graph->vertices[startVertex]->value;
+        *maxPath = addToPath(initializePath(1), startVertex);
+        return 1;
+    }
+
+    int* offsets;
+    int* targets;
+    int* reverseOffsets;
+    int* reverseTargets;
+    buildAdjacency(graph, false, &offsets, &targets);
+    buildAdjacency(graph, true, &reverseOffsets, &reverseTargets);
+
+    int words = (graph->numVertices + 63) / 64;
+    uint64_t* none = (uint64_t*)calloc(words, sizeof(uint64_t));
+    RegionScratch scratch = { (int*)malloc(graph->numVertices * sizeof(int)), (int*)calloc(graph->numVertices, sizeof(int)), 0 };
+    // Per half path: the record, its bitset, up to four hash slots and one join key
+    size_t itemBytes = sizeof(HalfPath) + words * sizeof(uint64_t) + 4 * sizeof(int) + sizeof(HalfPathKey);
+    size_t limit = HALF_PATH_BYTES / itemBytes;
+    if (limit > INT_MAX / 4) {
+        limit = INT_MAX / 4;
+    }
+    HalfPathSet forward = { NULL, NULL, NULL, 0, words, 0, 0, (int)limit };
+    HalfPathSet backward = { NULL, NULL, NULL, 0, words, 0, 0, (int)limit };
+
+    // No path sum exceeds the positive values reachable from the start, or falls below the negative ones
+    int status = 0;
+    int upper = reachableValue(graph, offsets, targets, &scratch, none, startVertex, endVertex);
+    if (upper != INT_MIN) {
+        long long lowest = 0;
+        for (int i = 0; i < graph->numVertices; i++) {
+            if (graph->vertices[i] && graph->vertices[i]->value < 0) {
+                lowest += graph->vertices[i]->value;
+            }
+        }
+        long long gap = (upper - lowest) / 64 + 1;
+        for (;;) {
+            long long threshold = upper - gap;
+            bool last = threshold <= lowest;
+            if (!meetInTheMiddle(graph, offsets, targets, reverseOffsets, reverseTargets, &forward, &backward, &scratch, startVertex, endVertex, last ? lowest : threshold, maxSum, maxPath)) {
+                status = -1;
+                break;
+            }
+            if (*maxPath) {
+                status = 1;
+                break;
+            }
+            if (last) {
+                break;
+            }
+            gap *= 4;
+        }
+    }
+
+    free(none);
+    free(scratch.queue);
+    free(scratch.marks);
+    free(forward.items);
+    free(forward.bits);
+    free(forward.table);
+    free(backward.items);
+    free(backward.bits);
+    free(backward.table);
+    free(offsets);
+    free(targets);
+    free(reverseOffsets);
+    free(reverseTargets);
+    return status;
+}
+
+/**
+ * Structure holding the state of Tarjan's strongly connected components algorithm.
+ */
+typedef struct {
+    int* index;      // Discovery index of each vertex (-1 while undiscovered)
+    int* low;        // Smallest discovery index reachable from each vertex's subtree
+    int* stack;      // Vertices of the components still being built
+    bool* onStack;   // Whether each vertex is currently on the stack
+    int* component;  // Component of each vertex, numbered in reverse topological order
+    int* members;    // Vertices grouped by component, in the order components are found
+    int* start;      // Offset of each component's first member in members
+    int counter;     // Next discovery index
+    int top;         // Number of vertices on the stack
+    int components;  // Number of components found
+    int placed;      // Number of vertices written to members
+} TarjanState;
+
+/**
+ * Visits a vertex in Tarjan's algorithm and emits its component once it is complete.
+ * A component is only emitted after every component reachable from it, so component
+ * numbers come out in reverse topological order of the condensed graph.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param state The algorithm state.
+ * @param v The vertex to visit.
+ */
+static void tarjanVisit(int* offsets, int* targets, TarjanState* state, int v) {
+    state->index[v] = state->low[v] = state->counter++;
+    state->stack[state->top++] = v;
+    state->onStack[v] = true;
+
+    for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+        int w = targets[e];
+        if (state->index[w] < 0) {
+            tarjanVisit(offsets, targets, state, w);
+            if (state->low[w] < state->low[v]) {
+                state->low[v] = state->low[w];
+            }
+        } else if (state->onStack[w] && state->index[w] < state->low[v]) {
+            state->low[v] = state->index[w];
+        }
+    }
+
+    if (state->low[v] == state->index[v]) {
+        // v is the root of a component: everything above it on the stack belongs to it
+        state->start[state->components] = state->placed;
+        int w;
+        do {
+            w = state->stack[--state->top];
+            state->onStack[w] = false;
+            state->component[w] = state->components;
+            state->members[state->placed++] = w;
+        } while (w != v);
+        state->components++;
+    }
+}
+
+/**
+ * Explores every simple path inside one strongly connected component from an entry vertex,
+ * recording for each vertex reached the best sum of a full path that ends there.
+ * @param graph The graph being searched.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param component Component of each vertex.
+ * @param vertex The vertex being added to the current path.
+ * @param visited An array indicating whether a vertex is on the current path.
+ * @param currentSum The sum of the full path before adding vertex (including the part before the component).
+ * @param entry The vertex where the path entered the component.
+ * @param out Best sum of a full path ending at each vertex.
+ * @param outEntry Entry vertex of the path recorded in out.
+ */
+static void componentSearch(Graph* graph, int* offsets, int* targets, int* component, int vertex, int* visited, int currentSum, int entry, int* out, int* outEntry) {
+    visited[vertex] = 1;
+    currentSum += graph->vertices[vertex]->value;
+    if (outEntry[vertex] < 0 || currentSum > out[vertex]) {
+        out[vertex] = currentSum;
+        outEntry[vertex] = entry;
+    }
+
+    for (int e = offsets[vertex]; e < offsets[vertex + 1]; e++) {
+        int next = targets[e];
+        if (component[next] == component[vertex] && !visited[next]) {
+            componentSearch(graph, offsets, targets, component, next, visited, currentSum, entry, out, outEntry);
+        }
+    }
+
+    visited[vertex] = 0;
+}
+
+/**
+ * Finds a simple path inside one component from the current vertex to a target vertex
+ * whose sum is exactly the one recorded by componentSearch.
+ * @param graph The graph being searched.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param component Component of each vertex.
+ * @param vertex The vertex being added to the current path.
+ * @param target The vertex the path must end at.
+ * @param visited An array indicating whether a vertex is on the current path.
+ * @param remaining The sum the path still has to collect, including vertex.
+ * @param currentPath The path built so far; holds the result when true is returned.
+ * @return True if a matching path was found, false otherwise.
+ */
+static bool componentPath(Graph* graph, int* offsets, int* targets, int* component, int vertex, int target, int* visited, int remaining, Path* currentPath) {
+    visited[vertex] = 1;
+    addToPath(currentPath, vertex);
+    remaining -= graph->vertices[vertex]->value;
+
+    if (vertex == target) {
+        if (remaining == 0) {
+            return true;
+        }
+    } else {
+        for (int e = offsets[vertex]; e < offsets[vertex + 1]; e++) {
+            int next = targets[e];
+            if (component[next] == component[vertex] && !visited[next] &&
+                componentPath(graph, offsets, targets, component, next, target, visited, remaining, currentPath)) {
+                return true;
+            }
+        }
+    }
+
+    currentPath->length--;
+    visited[vertex] = 0;
+    return false;
+}
+
+/**
+ * Solves the maximum sum path problem on a graph with cycles by condensing it into its
+ * strongly connected components.
+ * A simple path can never return to a component it has left, so it crosses the condensed
+ * DAG in topological order and visits each component in one contiguous stretch. Components
+ * are therefore processed in that order: the best sum on entering each vertex comes from
+ * the edges into it, and only components with more than one vertex are searched exhaustively,
+ * once per entry vertex.
+ * @param graph The graph to search.
+ * @param offsets Offsets of the successor lists.
+ * @param targets Successor lists.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum.
+ */
+static void condensedLongestPath(Graph* graph, int* offsets, int* targets, int* maxSum, Path** maxPath) {
+    int n = graph->numVertices;
+    TarjanState state;
+    state.index = (int*)malloc(n * sizeof(int));
+    state.low = (int*)malloc(n * sizeof(int));
+    state.stack = (int*)malloc(n * sizeof(int));
+    state.onStack = (bool*)calloc(n, sizeof(bool));
+    state.component = (int*)malloc(n * sizeof(int));
+    state.members = (int*)malloc(n * sizeof(int));
+    state.start = (int*)malloc((n + 1) * sizeof(int));
+    state.counter = state.top = state.components = state.placed = 0;
+    for (int i = 0; i < n; i++) {
+        state.index[i] = -1;
+        state.component[i] = -1;
+    }
+    for (int i = 0; i < n; i++) {
+        if (graph->vertices[i] && state.index[i] < 0) {
+            tarjanVisit(offsets, targets, &state, i);
+        }
+    }
+    state.start[state.components] = state.placed;
+
+    int* enter = (int*)calloc(n, sizeof(int)); // Best sum before entering each vertex (0 = start there)
+    int* enterFrom = (int*)malloc(n * sizeof(int));
+    int* out = (int*)malloc(n * sizeof(int));
+    int* outEntry = (int*)malloc(n * sizeof(int));
+    int* visited = (int*)calloc(n, sizeof(int));
+    int bestEnd = -1;
+    for (int i = 0; i < n; i++) {
+        enterFrom[i] = -1;
+        outEntry[i] = -1;
+    }
+
+    for (int c = state.components - 1; c >= 0; c--) {
+        for (int m = state.start[c]; m < state.start[c + 1]; m++) {
+            int entry = state.members[m];
+            componentSearch(graph, offsets, targets, state.component, entry, visited, enter[entry], entry, out, outEntry);
+        }
+        for (int m = state.start[c]; m < state.start[c + 1]; m++) {
+            int v = state.members[m];
+            if (bestEnd < 0 || out[v] > *maxSum) {
+                *maxSum = out[v];
+                bestEnd = v;
+            }
+            for (int e = offsets[v]; e < offsets[v + 1]; e++) {
+                int w = targets[e];
+                if (state.component[w] != c && out[v] > enter[w]) {
+                    enter[w] = out[v];
+                    enterFrom[w] = v;
+                }
+            }
+        }
+    }
+
+    // Rebuild the path backwards, one component stretch at a time
+    int* reversed = (int*)malloc(n * sizeof(int));
+    int length = 0;
+    Path* stretch = initializePath(n);
+    for (int v = bestEnd; v >= 0; ) {
+        int entry = outEntry[v];
+        stretch->length = 0;
+        componentPath(graph, offsets, targets, state.component, entry, v, visited, out[v] - enter[entry], stretch);
+        for (int i = stretch->length - 1; i >= 0; i--) {
+            visited[stretch->vertices[i]] = 0;
+            reversed[length++] = stretch->vertices[i];
+        }
+        v = enterFrom[entry];
+    }
+    *maxPath = initializePath(length);
+    for (int i = length - 1; i >= 0; i--) {
+        addToPath(*maxPath, reversed[i]);
+    }
+
+    freePath(stretch);
+    free(reversed);
+    free(enter);
+    free(enterFrom);
+    free(out);
+    free(outEntry);
+    free(visited);
+    free(state.index);
+    free(state.low);
+    free(state.stack);
+    free(state.onStack);
+    free(state.component);
+    free(state.members);
+    free(state.start);
+}
+
+/**
+ * Finds the maximum sum path in a graph, picking the fastest exact method for its shape.
+ * Kahn's algorithm first tries to order the vertices topologically; if that succeeds the
+ * graph is acyclic and a linear-time DP solves it. Otherwise the graph is condensed into
+ * strongly connected components with Tarjan's algorithm, the cyclic components are searched
+ * exhaustively and the DAG between them is solved by DP.
+ * @param graph The graph to search.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if the graph is empty).
+ * @return True if a path was found, false otherwise.
+ */
+bool solveMaxSumPath(Graph* graph, int* maxSum, Path** maxPath) {
+    *maxSum = INT_MIN;
+    *maxPath = NULL;
+
+    int present = countVertices(graph);
+    if (present == 0) {
+        return false;
+    }
+
+    int* offsets;
+    int* targets;
+    buildAdjacency(graph, false, &offsets, &targets);
+    int* order = (int*)malloc(graph->numVertices * sizeof(int));
+    int ordered = topologicalOrder(graph, offsets, targets, order);
+
+    if (ordered == present) {
+        dagLongestPath(graph, offsets, targets, order, ordered, maxSum, maxPath);
+    } else {
+        condensedLongestPath(graph, offsets, targets, maxSum, maxPath);
+    }
+
+    free(order);
+    free(offsets);
+    free(targets);
+    return true;
+}
+
 /**
  * Frees the memory allocated for a graph.
  * @param graph The graph to free.
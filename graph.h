@@ -60,6 +60,12 @@ typedef struct Graph {
  */
 Graph* createGraph(int numVertices);
 
+/**
+ * @brief Frees the memory allocated for a path.
+ * @param path The path to free.
+ */
+void freePath(Path* path);
+
 /**
  * @brief Copies a path.
  * @param path The original path to copy.
@@ -207,4 +213,57 @@ Path*** findMaxSumPathRecursive(Graph* graph, int startVertex, int endVertex, in
  */
 Path* addToPath(Path* path, int vertex);
 
+/**
+ * @brief Finds the maximum sum path that uses at most maxLength cells and whose sum stays within maxBudget.
+ * Acyclic graphs without a budget are solved in O(V + E) by a topological DP when there is
+ * no length limit (maxLength <= 0 or at least the vertex count), and otherwise by a layered
+ * DP over (vertex, steps used) in O(L * (V + E)) time and O(V * sqrt(L)) memory;
+ * cyclic graphs, or any graph with a budget, fall back to a pruned depth-first search.
+ * Setting a budget (maxBudget != INT_MAX) always takes the depth-first search, even on an
+ * acyclic graph, so budget queries run in exponential time in the worst case: the best sum
+ * under a budget is a knapsack-style choice that the per-layer DP cannot make exactly.
+ * A single vertex counts as a path of one cell.
+ * @param graph The graph to search.
+ * @param maxLength The maximum number of cells on the path (0 or less means no limit).
+ * @param maxBudget The maximum allowed path sum (INT_MAX means no budget).
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if none fits).
+ * @return True if a path satisfying the limits was found, false otherwise.
+ */
+bool findMaxSumPathConstrained(Graph* graph, int maxLength, int maxBudget, int* maxSum, Path** maxPath);
+
+/**
+ * @brief Finds the maximum sum path between two vertices with a bidirectional meet-in-the-middle search.
+ * Half paths are expanded from both endpoints (the end one over reverse edges) and joined
+ * where their visited sets share only the meeting vertex. Exact on cyclic graphs, and far
+ * cheaper than enumerating every start-to-end path with depthFirstSearch.
+ * Memory still grows exponentially with the vertex count. Each endpoint's half paths get a
+ * budget of about 1 GB; a half path costs roughly 56 bytes plus 8 bytes per 64 vertices, so
+ * the budget holds about 16 million half paths at 64 vertices but only about 6 million at
+ * 1000. A four-neighbour grid of 7x7 (49 vertices) takes seconds and a few hundred MB, while
+ * 8x8 (64 vertices) exceeds the budget. When that happens, or memory runs out, the search
+ * gives up and returns -1 rather than reporting that no path exists.
+ * @param graph The graph to search.
+ * @param startVertex The starting vertex of the path.
+ * @param endVertex The ending vertex of the path.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if none was found).
+ * @return 1 if a path was found, 0 if no path exists, or -1 if the search ran out of room
+ *         before it could decide (in which case a path may still exist).
+ */
+int bidirectionalSearch(Graph* graph, int startVertex, int endVertex, int* maxSum, Path** maxPath);
+
+/**
+ * @brief Finds the maximum sum path in a graph, picking the fastest exact method for its shape.
+ * Acyclic graphs (checked with Kahn's topological sort) are solved by a linear-time DP in
+ * topological order. Graphs with cycles are condensed into strongly connected components
+ * (Tarjan); only components with cycles are searched exhaustively, and the DAG between
+ * them is solved by DP. A single vertex counts as a path of one cell.
+ * @param graph The graph to search.
+ * @param maxSum Pointer to store the maximum sum found.
+ * @param maxPath Pointer to store the path with the maximum sum (NULL if the graph is empty).
+ * @return True if a path was found, false otherwise.
+ */
+bool solveMaxSumPath(Graph* graph, int* maxSum, Path** maxPath);
+
 #endif // GRAPH_H
@@ -1,5 +1,6 @@
 #include "graph.h"
 #include <stdio.h>
+#include <limits.h>
 
 /**
  * @mainpage Main Program for Graph Operations
@@ -9,6 +10,42 @@
  * finding the maximum sum path, and freeing the allocated memory for the graph.
  */
 
+/**
+ * @brief Prints the vertices of a path as "index - (value)" pairs.
+ * @param graph The graph containing the path.
+ * @param path The path to print.
+ */
+static void printPath(Graph* graph, Path* path) {
+    printf("Vertices (Index - Value): ");
+    for (int j = 0; j < path->length; j++) {
+        printf("%d - (%d) ", path->vertices[j], graph->vertices[path->vertices[j]]->value);
+        if (j != path->length - 1) {
+            printf("-> ");
+        }
+    }
+}
+
+/**
+ * @brief Prints the outcome of one of the path solvers and frees the path it returned.
+ * @param graph The graph that was searched.
+ * @param title A short description of the query.
+ * @param status 1 if a path was found, 0 if none exists, -1 if the solver gave up.
+ * @param sum The sum of the path found.
+ * @param path The path found, or NULL.
+ */
+static void reportPath(Graph* graph, const char* title, int status, int sum, Path* path) {
+    if (status == 1) {
+        printf("\nPath with Maximum Sum (%s):\n", title);
+        printPath(graph, path);
+        printf("\nSum: %d\n", sum);
+        freePath(path);
+    } else if (status == 0) {
+        printf("\nNo path found (%s).\n", title);
+    } else {
+        printf("\nSearch gave up (%s): the graph is too large for this solver.\n", title);
+    }
+}
+
 /**
  * @brief Main function demonstrating graph operations.
  *
@@ -32,6 +69,47 @@ int main() {
     Path* maxPath;
     findMaxSumPath(graph, &maxSum, &maxPath);
 
+    // Find the maximum sum path using at most 3 cells
+    int sum;
+    Path* path;
+    int found = findMaxSumPathConstrained(graph, 3, INT_MAX, &sum, &path);
+    reportPath(graph, "at most 3 cells", found, sum, path);
+
+    // Find the maximum sum path between the first and last cells
+    int lastVertex = numberOfVertices * numberOfVertices - 1;
+    found = bidirectionalSearch(graph, 0, lastVertex, &sum, &path);
+    reportPath(graph, "from first to last cell", found, sum, path);
+
+    // Find the maximum sum path with the fastest exact method for this graph
+    found = solveMaxSumPath(graph, &sum, &path);
+    reportPath(graph, "topological / SCC solver", found, sum, path);
+
+    // Build a cyclic version of the same grid by adding the reverse (left and up) edges,
+    // so the solvers take their cyclic fallbacks
+    Graph* cyclicGraph = createGraph(numberOfVertices * numberOfVertices);
+    loadAndSetConnectionRules(cyclicGraph, numberOfVertices, inputFilename);
+    for (int i = 0; i < graph->numVertices; i++) {
+        for (int j = 0; j < graph->numVertices; j++) {
+            if (graph->edges[i][j]) {
+                addEdge(cyclicGraph, j, i);
+            }
+        }
+    }
+
+    found = findMaxSumPathConstrained(cyclicGraph, 4, INT_MAX, &sum, &path);
+    reportPath(cyclicGraph, "cyclic grid, at most 4 cells", found, sum, path);
+
+    found = findMaxSumPathConstrained(cyclicGraph, 0, 1500, &sum, &path);
+    reportPath(cyclicGraph, "cyclic grid, sum within 1500", found, sum, path);
+
+    found = bidirectionalSearch(cyclicGraph, 0, lastVertex, &sum, &path);
+    reportPath(cyclicGraph, "cyclic grid, from first to last cell", found, sum, path);
+
+    found = solveMaxSumPath(cyclicGraph, &sum, &path);
+    reportPath(cyclicGraph, "cyclic grid, topological / SCC solver", found, sum, path);
+
+    freeGraph(cyclicGraph);
+
     // Free the allocated memory for the graph
     freeGraph(graph);
 